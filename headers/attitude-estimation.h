@@ -15,6 +15,7 @@
 #include <vector>
 #include <fstream>
 #include <string>
+#include <array>
 
 /**
  * @brief Accelerometer reading data represented by a struct containing the timestamp
@@ -48,6 +49,26 @@ struct AccelerometerReading {
         bool operator ==(const AccelerometerReading& other) const;
 };
 
+/**
+ * @brief Selection of the additional attitude representations to be calculated and
+ * written alongside the roll and pitch angles in [rad]. All of them are disabled by default.
+ * 
+ */
+struct AttitudeOutputFormat {
+    public:
+        bool degrees = false; // whether to output the roll and pitch angles in [deg]
+        bool quaternion = false; // whether to output the attitude quaternion
+        bool rotation_matrix = false; // whether to output the attitude rotation matrix (DCM)
+
+        /**
+         * @brief Check if any additional attitude representation is selected
+         * 
+         * @return true 
+         * @return false 
+         */
+        bool any() const;
+};
+
 /**
  * @brief Attitude estimation represented by a struct containing the timestamp
  * of the corresponding measurements and the estimated roll and pitch angles.
@@ -78,12 +99,27 @@ struct AttitudeEstimation {
         bool operator ==(const AttitudeEstimation& other) const;
 };
 
+/**
+ * @brief Additional attitude representations stored in vectors parallel to a vector of
+ * attitude estimations. Only the vectors of the representations selected in the format
+ * are filled in, so that unselected representations take no memory.
+ * 
+ */
+struct AttitudeRepresentations {
+    public:
+        AttitudeOutputFormat format; // the selected attitude representations
+        std::vector<std::array<double, 2>> degrees; // the roll and pitch angles in [deg]
+        std::vector<std::array<double, 4>> quaternion; // the attitude quaternions in the order w, x, y, z
+        std::vector<std::array<double, 9>> rotation_matrix; // the body to navigation frame rotation matrices in row-major order
+};
+
 /**
  * @brief Function that writes a file containing attitude estimation data
  * 
  * @param attitudeEstimation A vector containing the estimated attitude data
  * @param attitudeEstimationFilePath The path to the attitude estimation data file to be created
+ * @param representations The additional attitude representations to be written after the roll and pitch angles, as selected in their format
  */
-void writeAttitudeEstimationFile(std::vector<AttitudeEstimation> attitudeEstimation, std::string attitudeEstimationFilePath);
+void writeAttitudeEstimationFile(const std::vector<AttitudeEstimation>& attitudeEstimation, std::string attitudeEstimationFilePath, const AttitudeRepresentations& representations = AttitudeRepresentations());
 
 #endif
\ No newline at end of file
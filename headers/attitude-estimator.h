@@ -10,7 +10,9 @@
 
 #include <vector>
 #include <cmath>
+#include <algorithm>
 #include "attitude-estimation.h"
+#include "window-statistics.h"
 
 /**
  * @brief Class that represents a set of attitude estimations through a vector in
@@ -24,15 +26,38 @@ class AttitudeEstimator {
          * @brief Construct a new AttitudeEstimator object
          * 
          * @param accelerometerReading A vector of accelerometer data readings
+         * @param format The additional attitude representations to be calculated for each estimation
+         * @param statistics The sliding window statistics to be fed with each estimation, if enabled
          */
-        AttitudeEstimator(std::vector<AccelerometerReading> accelerometerReading);
+        AttitudeEstimator(std::vector<AccelerometerReading> accelerometerReading, AttitudeOutputFormat format = AttitudeOutputFormat(), WindowStatistics statistics = WindowStatistics());
 
         /**
          * @brief Get the resulting attitude estimation vector
          * 
-         * @return std::vector<AttitudeEstimation> A vector containing all the estimated attitude data
+         * @return const std::vector<AttitudeEstimation>& A vector containing all the estimated attitude data
+         */
+        const std::vector<AttitudeEstimation>& getAttitudeEstimation() const;
+
+        /**
+         * @brief Get the additional attitude representations selected for the estimation
+         * 
+         * @return AttitudeOutputFormat The selected attitude representations
+         */
+        AttitudeOutputFormat getOutputFormat() const;
+
+        /**
+         * @brief Get the additional attitude representations, parallel to the attitude estimation vector
+         * 
+         * @return const AttitudeRepresentations& The selected attitude representations and their values
+         */
+        const AttitudeRepresentations& getAttitudeRepresentations() const;
+
+        /**
+         * @brief Get the sliding window statistics gathered during the estimation
+         * 
+         * @return const WindowStatistics& The window statistics containing the summaries and alerts
          */
-        std::vector<AttitudeEstimation> getAttitudeEstimation();
+        const WindowStatistics& getWindowStatistics() const;
 
     private:
         /**
@@ -41,9 +66,23 @@ class AttitudeEstimator {
          */
         std::vector<AttitudeEstimation> estimation;
 
+        /**
+         * @brief Stores the selected additional attitude representations and their values
+         * 
+         */
+        AttitudeRepresentations representations;
+
+        /**
+         * @brief Stores the sliding window statistics
+         * 
+         */
+        WindowStatistics windowStatistics;
+
         /**
          * @brief Estimate the attitude corresponding to accelerometer data readings by following
-         * the aerospace rotation sequence, that is, the sequence yaw -> pitch -> roll.
+         * the aerospace rotation sequence, that is, the sequence yaw -> pitch -> roll. The
+         * additional representations selected in the output format and the window statistics, if
+         * enabled, are calculated in the same loop.
          * 
          * @param accelerometerReading A set of accelerometer data readings
          * @return std::vector<AttitudeEstimation> A vector containing all the estimated attitude data
@@ -51,28 +90,66 @@ class AttitudeEstimator {
         std::vector<AttitudeEstimation> estimateAttitude(std::vector<AccelerometerReading> accelerometerReading);
 
         /**
-         * @brief Calculate the roll angle corresponding to a single accelerometer reading by
-         * following the aerospace rotation sequence, that is, the sequence yaw -> pitch -> roll.
-         * It uses the std::atan2 function to keep the estimated angle between -pi rad and pi rad.
-         * It includes a fraction mu of the square of the x axis reading in order to prevent the 
-         * denominator of the equation from being zero in case the z axis reading is zero.
+         * @brief Numerators and denominators of the roll and pitch equations of a single
+         * accelerometer reading. They are calculated once per reading and shared by the angle
+         * calculations and the additional attitude representations.
+         * 
+         */
+        struct AttitudeTerms {
+            double rollNumerator; // the y axis reading
+            double rollDenominator; // the signed square root of the z axis reading squared plus mu times the x axis reading squared
+            double pitchNumerator; // the negated x axis reading
+            double pitchDenominator; // the square root of the sum of the y and z axis readings squared
+            double accelMagnitude; // the norm of the pitch numerator and denominator, that is, the accelerometer magnitude, only calculated when needed
+        };
+
+        /**
+         * @brief Parameter used to prevent the denominator of the roll equation from ever being zero
+         * 
+         */
+        double mu = 0.01;
+
+        /**
+         * @brief Calculate the numerators and denominators of the roll and pitch equations corresponding
+         * to a single accelerometer reading by following the aerospace rotation sequence, that is, the
+         * sequence yaw -> pitch -> roll. The roll denominator includes a fraction mu of the square of the
+         * x axis reading in order to prevent it from being zero in case the z axis reading is zero.
          * 
          * @param reading A single accelerometer reading
-         * @param mu Parameter used to prevent the denominator of the equation from ever being zero
+         * @return AttitudeTerms The numerators and denominators of the roll and pitch equations
+         */
+        AttitudeTerms calculateTerms(AccelerometerReading reading);
+
+        /**
+         * @brief Calculate the roll angle from the terms of a single accelerometer reading.
+         * It uses the std::atan2 function to keep the estimated angle between -pi rad and pi rad.
+         * 
+         * @param terms The numerators and denominators of the roll and pitch equations
          * @return double The estimated roll angle between -pi rad and pi rad
          */
-        double calculateRoll(AccelerometerReading reading, double mu = 0.01);
+        double calculateRoll(AttitudeTerms terms);
 
         /**
-         * @brief Calculate the pitch angle corresponding to a single accelerometer reading by
-         * following the aerospace rotation sequence, that is, the sequence yaw -> pitch -> roll.
+         * @brief Calculate the pitch angle from the terms of a single accelerometer reading.
          * It uses the std::atan function to keep the estimated angle between -pi/2 rad and
          * pi/2 rad.
          * 
-         * @param reading A single accelerometer reading
+         * @param terms The numerators and denominators of the roll and pitch equations
          * @return double The estimated pitch angle between -pi/2 rad and pi/2 rad
          */
-        double calculatePitch(AccelerometerReading reading);
+        double calculatePitch(AttitudeTerms terms);
+
+        /**
+         * @brief Append the additional attitude representations selected in the output format for
+         * a single estimation. The sines and cosines of the roll and pitch angles are derived from
+         * the same terms passed to calculateRoll and calculatePitch, so no trigonometric function
+         * is evaluated again. The yaw angle is taken as zero, since it cannot be observed by an
+         * accelerometer.
+         * 
+         * @param estimation The estimation whose roll and pitch angles are already calculated
+         * @param terms The numerators and denominators of the roll and pitch equations of the estimation
+         */
+        void calculateRepresentations(const AttitudeEstimation& estimation, AttitudeTerms terms);
 
         /**
          * @brief Determine the mathematical sign of a number. It returns +1 if the number is
@@ -0,0 +1,175 @@
+/**
+ * @file window-statistics.h
+ * @author agent (agent@local)
+ * @brief Online sliding window statistics of the accelerometer magnitude and attitude
+ * @date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#ifndef _WINDOW_STATISTICS_H_
+#define _WINDOW_STATISTICS_H_
+
+#include <iostream>
+#include <vector>
+#include <deque>
+#include <fstream>
+#include <string>
+#include <cmath>
+#include "attitude-estimation.h"
+
+/**
+ * @brief Summary of the statistics over a time window represented by a struct containing
+ * the timestamp at the end of the window, the number of samples in it, the mean and variance
+ * of each monitored quantity and whether any threshold was exceeded.
+ * 
+ */
+struct WindowSummary {
+    public:
+        int time_stamp_ms = 0; // the timestamp of the last sample in the window in [ms]
+        int sample_count = 0; // the number of samples in the window
+        double accel_magnitude_mean = 0.0; // the mean accelerometer magnitude in [mg]
+        double accel_magnitude_variance = 0.0; // the accelerometer magnitude variance in [mg^2]
+        double roll_mean = 0.0; // the mean roll angle between -pi rad and pi rad
+        double roll_variance = 0.0; // the roll angle variance in [rad^2]
+        double pitch_mean = 0.0; // the mean pitch angle in [rad]
+        double pitch_variance = 0.0; // the pitch angle variance in [rad^2]
+        bool vibration_alert = false; // whether the accelerometer magnitude standard deviation exceeds its threshold
+        bool attitude_alert = false; // whether the roll or pitch standard deviation exceeds its threshold
+        bool vibration_alert_started = false; // whether the vibration threshold started being exceeded at this sample
+        bool attitude_alert_started = false; // whether the attitude threshold started being exceeded at this sample
+};
+
+/**
+ * @brief Running mean and variance of a quantity by Welford's algorithm, supporting both
+ * the insertion and the removal of samples so that it can follow a sliding window in O(1).
+ * 
+ */
+struct WelfordAccumulator {
+    public:
+        int count = 0; // the number of accumulated samples
+        double mean = 0.0; // the mean of the accumulated samples
+        double m2 = 0.0; // the sum of the squared deviations from the mean
+
+        /**
+         * @brief Add a sample to the accumulator
+         * 
+         * @param value The sample to be added
+         */
+        void add(double value);
+
+        /**
+         * @brief Remove a sample previously added to the accumulator
+         * 
+         * @param value The sample to be removed
+         */
+        void remove(double value);
+
+        /**
+         * @brief Get the population variance of the accumulated samples
+         * 
+         * @return double The variance, or zero if there are no samples
+         */
+        double variance() const;
+};
+
+/**
+ * @brief Class that keeps the running mean and variance of the accelerometer magnitude and of
+ * the roll and pitch angles over a sliding time window. Each sample is processed in amortized
+ * O(1), so it can be fed from within the estimation loop. A summary is recorded every time the
+ * window length elapses, and an alert is recorded whenever a standard deviation starts to
+ * exceed its threshold.
+ * 
+ */
+class WindowStatistics {
+    public:
+        /**
+         * @brief Construct a new WindowStatistics object
+         * 
+         * @param windowLengthMs_ The length of the sliding window in [ms]. Zero disables the statistics
+         * @param vibrationThreshold_ The accelerometer magnitude standard deviation threshold in [mg]. Zero disables it
+         * @param attitudeThreshold_ The roll and pitch standard deviation threshold in [rad]. Zero disables it
+         */
+        WindowStatistics(int windowLengthMs_ = 0, double vibrationThreshold_ = 0.0, double attitudeThreshold_ = 0.0);
+
+        /**
+         * @brief Check if the statistics are enabled
+         * 
+         * @return true
+         * @return false
+         */
+        bool isEnabled() const;
+
+        /**
+         * @brief Add a sample to the sliding window, dropping the samples that fall out of it
+         * 
+         * @param estimation The attitude estimation of the sample
+         * @param accelMagnitudeValue The accelerometer magnitude of the sample in [mg], as already calculated by the estimator
+         */
+        void addSample(const AttitudeEstimation& estimation, double accelMagnitudeValue);
+
+        /**
+         * @brief Get the summaries recorded at the end of each window
+         * 
+         * @return const std::vector<WindowSummary>& A vector containing the window summaries
+         */
+        const std::vector<WindowSummary>& getWindowSummaries() const;
+
+        /**
+         * @brief Get the summaries recorded whenever a threshold started being exceeded. The
+         * vibration_alert_started and attitude_alert_started flags tell which thresholds did.
+         * 
+         * @return const std::vector<WindowSummary>& A vector containing the alert summaries
+         */
+        const std::vector<WindowSummary>& getAlerts() const;
+
+    private:
+        /**
+         * @brief Sample kept in the sliding window so that it can be removed from the accumulators later
+         * 
+         */
+        struct WindowSample {
+            int time_stamp_ms; // the timestamp of the sample in [ms]
+            double accel_magnitude; // the accelerometer magnitude in [mg]
+            double roll; // the unwrapped roll angle in [rad]
+            double pitch; // the pitch angle in [rad]
+        };
+
+        int windowLengthMs; // the length of the sliding window in [ms]
+        double vibrationThreshold; // the accelerometer magnitude standard deviation threshold in [mg]
+        double attitudeThreshold; // the roll and pitch standard deviation threshold in [rad]
+
+        std::deque<WindowSample> samples; // the samples currently in the window
+        WelfordAccumulator accelMagnitude; // the running statistics of the accelerometer magnitude
+        WelfordAccumulator roll; // the running statistics of the unwrapped roll angle
+        WelfordAccumulator pitch; // the running statistics of the pitch angle
+
+        int firstTimeStampMs = 0; // the timestamp of the first sample ever added in [ms]
+        int lastSummaryTimeStampMs = 0; // the timestamp at which the last summary was recorded in [ms]
+        double previousRoll = 0.0; // the previous roll angle between -pi rad and pi rad
+        double previousUnwrappedRoll = 0.0; // the previous unwrapped roll angle in [rad]
+        bool vibrationAlertActive = false; // whether the vibration threshold was exceeded at the previous sample
+        bool attitudeAlertActive = false; // whether the attitude threshold was exceeded at the previous sample
+
+        std::vector<WindowSummary> summaries; // the recorded window summaries
+        std::vector<WindowSummary> alerts; // the recorded alerts
+
+        /**
+         * @brief Summarize the samples currently in the window
+         * 
+         * @param time_stamp_ms The timestamp of the last sample in the window in [ms]
+         * @return WindowSummary The summary of the window
+         */
+        WindowSummary summarize(int time_stamp_ms);
+};
+
+/**
+ * @brief Function that writes a file containing window statistics summaries
+ * 
+ * @param windowSummaries A vector containing the window summaries
+ * @param windowSummaryFilePath The path to the window statistics file to be created
+ */
+void writeWindowSummaryFile(const std::vector<WindowSummary>& windowSummaries, std::string windowSummaryFilePath);
+
+#endif
\ No newline at end of file
@@ -13,27 +13,157 @@
 
 #include <iostream>
 #include <string>
+#include <cmath>
 #include "attitude-estimation.h"
 #include "accelerometer-data.h"
 #include "attitude-estimator.h"
+#include "window-statistics.h"
+
+/**
+ * @brief Parse the value of a command line option of the form --name=value as a real number.
+ * The whole value must be a valid finite number for the parsing to succeed.
+ * 
+ * @param option The command line option
+ * @param value The parsed value
+ * @return true 
+ * @return false 
+ */
+bool parseOptionValue(std::string option, double& value)
+{
+    std::string text = option.substr(option.find('=') + 1);
+    try {
+        size_t parsedLength = 0;
+        value = std::stod(text, &parsedLength);
+        return (parsedLength == text.size()) && std::isfinite(value);
+    }
+    catch (const std::exception&) {
+        return false;
+    }
+}
+
+/**
+ * @brief Parse the value of a command line option of the form --name=value as an integer.
+ * The whole value must be a valid integer for the parsing to succeed.
+ * 
+ * @param option The command line option
+ * @param value The parsed value
+ * @return true 
+ * @return false 
+ */
+bool parseOptionValue(std::string option, int& value)
+{
+    std::string text = option.substr(option.find('=') + 1);
+    try {
+        size_t parsedLength = 0;
+        value = std::stoi(text, &parsedLength);
+        return parsedLength == text.size();
+    }
+    catch (const std::exception&) {
+        return false;
+    }
+}
 
 /**
  * @brief Read a log file containing data generated by an accelerometer
  * and produce an output file with the corresponding attitude estimation.
  * 
- * @param argv[0] Accelerometer data file path
- * @param argv[1] Desired attitude estimation data file path
+ * @param argv[1] Accelerometer data file path
+ * @param argv[2] Desired attitude estimation data file path
+ * @param argv[3...] Optional additional output columns: --degrees, --quaternion and/or --dcm,
+ * and optional window statistics: --stats=<path>, --window=<ms>, --vibration-threshold=<mg>
+ * and --attitude-threshold=<rad>
  */
 int main(int argc, char *argv[]) {
+    if (argc < 3) {
+        std::cout << "Usage: " << argv[0] << " <accelerometer_data_file_path> <attitude_estimation_data_file_path> [--degrees] [--quaternion] [--dcm] [--stats=<path>] [--window=<ms>] [--vibration-threshold=<mg>] [--attitude-threshold=<rad>]\n";
+        return 1;
+    }
+
     // Read input paths for the accelerometer data file and the desired attitude estimation data file
     std::string accelerometerDataFilePath = argv[1], attitudeEstimationDataFilePath = argv[2];
 
+    // Read the additional attitude representations to be written to the output file
+    AttitudeOutputFormat outputFormat;
+
+    // Read the window statistics settings, which are only enabled when a statistics file path is given
+    std::string windowSummaryFilePath;
+    int windowLengthMs = 1000;
+    double vibrationThreshold = 0.0, attitudeThreshold = 0.0;
+    std::string statisticsOption; // the last window statistics setting given, to report it if --stats is missing
+
+    for (int i = 3; i < argc; i++) {
+        std::string option = argv[i];
+        if (option == "--degrees") {
+            outputFormat.degrees = true;
+        }
+        else if (option == "--quaternion") {
+            outputFormat.quaternion = true;
+        }
+        else if (option == "--dcm") {
+            outputFormat.rotation_matrix = true;
+        }
+        else if (option.rfind("--stats=", 0) == 0) {
+            windowSummaryFilePath = option.substr(option.find('=') + 1);
+            if (windowSummaryFilePath.empty()) {
+                std::cout << "Invalid option " << option << ": the window statistics file path is empty\n";
+                return 1;
+            }
+        }
+        else if (option.rfind("--window=", 0) == 0) {
+            if (!parseOptionValue(option, windowLengthMs) || windowLengthMs <= 0) {
+                std::cout << "Invalid option " << option << ": the window length must be a positive integer in [ms]\n";
+                return 1;
+            }
+            statisticsOption = option;
+        }
+        else if (option.rfind("--vibration-threshold=", 0) == 0) {
+            if (!parseOptionValue(option, vibrationThreshold) || vibrationThreshold < 0) {
+                std::cout << "Invalid option " << option << ": the vibration threshold must be a non-negative number in [mg]\n";
+                return 1;
+            }
+            statisticsOption = option;
+        }
+        else if (option.rfind("--attitude-threshold=", 0) == 0) {
+            if (!parseOptionValue(option, attitudeThreshold) || attitudeThreshold < 0) {
+                std::cout << "Invalid option " << option << ": the attitude threshold must be a non-negative number in [rad]\n";
+                return 1;
+            }
+            statisticsOption = option;
+        }
+        else {
+            std::cout << "Unknown option " << option << '\n';
+            return 1;
+        }
+    }
+
+    // The window statistics settings have no effect without a statistics file
+    if (windowSummaryFilePath.empty() && !statisticsOption.empty()) {
+        std::cout << "Option " << statisticsOption << " requires --stats=<path>\n";
+        return 1;
+    }
+
     // Read accelerometer data from the accelerometer data file
     AccelerometerData accelerometerData = AccelerometerData(accelerometerDataFilePath);
 
-    // Generate vector of attitude estimations from the read accelerometer data
-    AttitudeEstimator attitudeEstimator = AttitudeEstimator(accelerometerData.getAccelerometerData());
+    // Generate vector of attitude estimations from the read accelerometer data, gathering the window statistics in the same pass
+    AttitudeEstimator attitudeEstimator = AttitudeEstimator(accelerometerData.getAccelerometerData(), outputFormat, WindowStatistics(windowSummaryFilePath.empty() ? 0 : windowLengthMs, vibrationThreshold, attitudeThreshold));
 
     // Write file containing the calculated attitude estimations
-    writeAttitudeEstimationFile(attitudeEstimator.getAttitudeEstimation(), attitudeEstimationDataFilePath);
+    writeAttitudeEstimationFile(attitudeEstimator.getAttitudeEstimation(), attitudeEstimationDataFilePath, attitudeEstimator.getAttitudeRepresentations());
+
+    // Write file containing the window summaries and report the threshold alerts
+    if (!windowSummaryFilePath.empty()) {
+        const WindowStatistics& windowStatistics = attitudeEstimator.getWindowStatistics();
+        writeWindowSummaryFile(windowStatistics.getWindowSummaries(), windowSummaryFilePath);
+
+        const std::vector<WindowSummary>& alerts = windowStatistics.getAlerts();
+        for (int i = 0; i < alerts.size(); i++) {
+            if (alerts[i].vibration_alert_started) {
+                std::cout << "Vibration alert at " << alerts[i].time_stamp_ms << " ms: accelerometer magnitude standard deviation of " << std::sqrt(alerts[i].accel_magnitude_variance) << " mg\n";
+            }
+            if (alerts[i].attitude_alert_started) {
+                std::cout << "Attitude alert at " << alerts[i].time_stamp_ms << " ms: roll and pitch standard deviations of " << std::sqrt(alerts[i].roll_variance) << " rad and " << std::sqrt(alerts[i].pitch_variance) << " rad\n";
+            }
+        }
+    }
 }
\ No newline at end of file
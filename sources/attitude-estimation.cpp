@@ -46,6 +46,17 @@ bool AccelerometerReading::operator ==(const AccelerometerReading& other) const
     }
 }
 
+/**
+ * @brief Check if any additional attitude representation is selected
+ * 
+ * @return true 
+ * @return false 
+ */
+bool AttitudeOutputFormat::any() const
+{
+    return degrees || quaternion || rotation_matrix;
+}
+
 /**
  * @brief Construct a new AttitudeEstimation::AttitudeEstimation object
  * 
@@ -85,8 +96,9 @@ bool AttitudeEstimation::operator ==(const AttitudeEstimation& other) const
  * 
  * @param attitudeEstimation A vector containing the estimated attitude data
  * @param attitudeEstimationFilePath The path to the attitude estimation data file to be created
+ * @param representations The additional attitude representations to be written after the roll and pitch angles, as selected in their format
  */
-void writeAttitudeEstimationFile(std::vector<AttitudeEstimation> attitudeEstimation, std::string attitudeEstimationFilePath)
+void writeAttitudeEstimationFile(const std::vector<AttitudeEstimation>& attitudeEstimation, std::string attitudeEstimationFilePath, const AttitudeRepresentations& representations)
 {
     // Check if the attitude estimation vector contains data
     if (attitudeEstimation.size() == 0) {
@@ -94,6 +106,14 @@ void writeAttitudeEstimationFile(std::vector<AttitudeEstimation> attitudeEstimat
         return;
     }
 
+    // Check if every selected attitude representation has one element per attitude estimation
+    const AttitudeOutputFormat& format = representations.format;
+    if ((format.degrees && representations.degrees.size() != attitudeEstimation.size()) ||
+        (format.quaternion && representations.quaternion.size() != attitudeEstimation.size()) ||
+        (format.rotation_matrix && representations.rotation_matrix.size() != attitudeEstimation.size())) {
+        throw std::runtime_error("Error: the selected attitude representations do not match the attitude estimation data");
+    }
+
     // Create attitude estimation data file
     std::ofstream attitudeEstimationFile;
     attitudeEstimationFile.open(attitudeEstimationFilePath);
@@ -102,7 +122,21 @@ void writeAttitudeEstimationFile(std::vector<AttitudeEstimation> attitudeEstimat
     if(attitudeEstimationFile.is_open())
     {
         for(int i=0; i<attitudeEstimation.size(); i++){
-            attitudeEstimationFile << attitudeEstimation[i].time_stamp_ms << "; " << attitudeEstimation[i].roll << "; " << attitudeEstimation[i].pitch << '\n';
+            attitudeEstimationFile << attitudeEstimation[i].time_stamp_ms << "; " << attitudeEstimation[i].roll << "; " << attitudeEstimation[i].pitch;
+            if (format.degrees) {
+                attitudeEstimationFile << "; " << representations.degrees[i][0] << "; " << representations.degrees[i][1];
+            }
+            if (format.quaternion) {
+                for (int j = 0; j < representations.quaternion[i].size(); j++) {
+                    attitudeEstimationFile << "; " << representations.quaternion[i][j];
+                }
+            }
+            if (format.rotation_matrix) {
+                for (int j = 0; j < representations.rotation_matrix[i].size(); j++) {
+                    attitudeEstimationFile << "; " << representations.rotation_matrix[i][j];
+                }
+            }
+            attitudeEstimationFile << '\n';
         }
         attitudeEstimationFile.close();
         std::cout << "Attitude estimation data successfully written to " << attitudeEstimationFilePath << '\n';
@@ -14,25 +14,61 @@
  * @brief Construct a new Attitude Estimator:: Attitude Estimator object
  * 
  * @param accelerometerReading A vector of accelerometer data readings
+ * @param format The additional attitude representations to be calculated for each estimation
+ * @param statistics The sliding window statistics to be fed with each estimation, if enabled
  */
-AttitudeEstimator::AttitudeEstimator(std::vector<AccelerometerReading> accelerometerReading)
+AttitudeEstimator::AttitudeEstimator(std::vector<AccelerometerReading> accelerometerReading, AttitudeOutputFormat format, WindowStatistics statistics)
 {
+    representations.format = format;
+    windowStatistics = statistics;
     estimation = estimateAttitude(accelerometerReading);
 }
 
 /**
  * @brief Get the resulting attitude estimation vector
  * 
- * @return std::vector<AttitudeEstimation> A vector containing all the estimated attitude data
+ * @return const std::vector<AttitudeEstimation>& A vector containing all the estimated attitude data
  */
-std::vector<AttitudeEstimation> AttitudeEstimator::getAttitudeEstimation()
+const std::vector<AttitudeEstimation>& AttitudeEstimator::getAttitudeEstimation() const
 {
     return estimation;
 }
 
+/**
+ * @brief Get the additional attitude representations selected for the estimation
+ * 
+ * @return AttitudeOutputFormat The selected attitude representations
+ */
+AttitudeOutputFormat AttitudeEstimator::getOutputFormat() const
+{
+    return representations.format;
+}
+
+/**
+ * @brief Get the additional attitude representations, parallel to the attitude estimation vector
+ * 
+ * @return const AttitudeRepresentations& The selected attitude representations and their values
+ */
+const AttitudeRepresentations& AttitudeEstimator::getAttitudeRepresentations() const
+{
+    return representations;
+}
+
+/**
+ * @brief Get the sliding window statistics gathered during the estimation
+ * 
+ * @return const WindowStatistics& The window statistics containing the summaries and alerts
+ */
+const WindowStatistics& AttitudeEstimator::getWindowStatistics() const
+{
+    return windowStatistics;
+}
+
 /**
  * @brief Estimate the attitude corresponding to accelerometer data readings by following
- * the aerospace rotation sequence, that is, the sequence yaw -> pitch -> roll.
+ * the aerospace rotation sequence, that is, the sequence yaw -> pitch -> roll. The
+ * additional representations selected in the output format and the window statistics, if
+ * enabled, are calculated in the same loop.
  * 
  * @param accelerometerData A set of accelerometer data readings
  * @return std::vector<AttitudeEstimation> A vector containing all the estimated attitude data
@@ -40,42 +76,141 @@ std::vector<AttitudeEstimation> AttitudeEstimator::getAttitudeEstimation()
 std::vector<AttitudeEstimation> AttitudeEstimator::estimateAttitude(std::vector<AccelerometerReading> accelerometerData)
 {   
     std::vector<AttitudeEstimation> calculatedEstimation;
+    calculatedEstimation.reserve(accelerometerData.size());
+
+    // Only reserve memory for the selected attitude representations
+    const AttitudeOutputFormat& outputFormat = representations.format;
+    if (outputFormat.degrees) {
+        representations.degrees.reserve(accelerometerData.size());
+    }
+    if (outputFormat.quaternion) {
+        representations.quaternion.reserve(accelerometerData.size());
+    }
+    if (outputFormat.rotation_matrix) {
+        representations.rotation_matrix.reserve(accelerometerData.size());
+    }
+
+    // The accelerometer magnitude is shared by the quaternion, the rotation matrix and the window statistics
+    bool needsAccelMagnitude = outputFormat.quaternion || outputFormat.rotation_matrix || windowStatistics.isEnabled();
 
     for (int i = 0; i < accelerometerData.size(); i++) {
-        calculatedEstimation.push_back(AttitudeEstimation(accelerometerData[i].time_stamp_ms,calculateRoll(accelerometerData[i]),calculatePitch(accelerometerData[i])));
+        AttitudeTerms terms = calculateTerms(accelerometerData[i]);
+        if (needsAccelMagnitude) {
+            terms.accelMagnitude = std::sqrt(terms.pitchNumerator*terms.pitchNumerator + terms.pitchDenominator*terms.pitchDenominator);
+        }
+        calculatedEstimation.push_back(AttitudeEstimation(accelerometerData[i].time_stamp_ms,calculateRoll(terms),calculatePitch(terms)));
+        if (outputFormat.any()) {
+            calculateRepresentations(calculatedEstimation.back(), terms);
+        }
+        if (windowStatistics.isEnabled()) {
+            windowStatistics.addSample(calculatedEstimation.back(), terms.accelMagnitude);
+        }
     }
 
     return calculatedEstimation;
 }
 
 /**
- * @brief Calculate the roll angle corresponding to a single accelerometer reading by
- * following the aerospace rotation sequence, that is, the sequence yaw -> pitch -> roll.
- * It uses the std::atan2 function to keep the estimated angle between -pi rad and pi rad.
- * It includes a fraction mu of the square of the x axis reading in order to prevent the 
- * denominator of the equation from being zero in case the z axis reading is zero.
+ * @brief Calculate the numerators and denominators of the roll and pitch equations corresponding
+ * to a single accelerometer reading by following the aerospace rotation sequence, that is, the
+ * sequence yaw -> pitch -> roll. The roll denominator includes a fraction mu of the square of the
+ * x axis reading in order to prevent it from being zero in case the z axis reading is zero.
  * 
  * @param reading A single accelerometer reading
- * @param mu Parameter used to prevent the denominator of the equation from ever being zero
+ * @return AttitudeEstimator::AttitudeTerms The numerators and denominators of the roll and pitch equations
+ */
+AttitudeEstimator::AttitudeTerms AttitudeEstimator::calculateTerms(AccelerometerReading reading)
+{
+    AttitudeTerms terms;
+    terms.rollNumerator = reading.accel_y_axis;
+    terms.rollDenominator = sign(reading.accel_z_axis)*std::sqrt(reading.accel_z_axis*reading.accel_z_axis + mu*reading.accel_x_axis*reading.accel_x_axis);
+    terms.pitchNumerator = -reading.accel_x_axis;
+    terms.pitchDenominator = std::sqrt(reading.accel_y_axis*reading.accel_y_axis + reading.accel_z_axis*reading.accel_z_axis);
+    terms.accelMagnitude = NAN;
+    return terms;
+}
+
+/**
+ * @brief Calculate the roll angle from the terms of a single accelerometer reading.
+ * It uses the std::atan2 function to keep the estimated angle between -pi rad and pi rad.
+ * 
+ * @param terms The numerators and denominators of the roll and pitch equations
  * @return double The estimated roll angle between -pi rad and pi rad
  */
-double AttitudeEstimator::calculateRoll(AccelerometerReading reading, double mu)
+double AttitudeEstimator::calculateRoll(AttitudeTerms terms)
 {
-    return std::atan2(reading.accel_y_axis,(sign(reading.accel_z_axis)*std::sqrt(reading.accel_z_axis*reading.accel_z_axis + mu*reading.accel_x_axis*reading.accel_x_axis)));
+    return std::atan2(terms.rollNumerator, terms.rollDenominator);
 }
 
 /**
- * @brief Calculate the pitch angle corresponding to a single accelerometer reading by
- * following the aerospace rotation sequence, that is, the sequence yaw -> pitch -> roll.
+ * @brief Calculate the pitch angle from the terms of a single accelerometer reading.
  * It uses the std::atan function to keep the estimated angle between -pi/2 rad and
  * pi/2 rad.
  * 
- * @param reading A single accelerometer reading
+ * @param terms The numerators and denominators of the roll and pitch equations
  * @return double The estimated pitch angle between -pi/2 rad and pi/2 rad
  */
-double AttitudeEstimator::calculatePitch(AccelerometerReading reading)
+double AttitudeEstimator::calculatePitch(AttitudeTerms terms)
+{
+    return std::atan(terms.pitchNumerator/terms.pitchDenominator);
+}
+
+/**
+ * @brief Append the additional attitude representations selected in the output format for
+ * a single estimation. The sines and cosines of the roll and pitch angles are derived from
+ * the same terms passed to calculateRoll and calculatePitch, so no trigonometric function
+ * is evaluated again. The yaw angle is taken as zero, since it cannot be observed by an
+ * accelerometer.
+ * 
+ * @param estimation The estimation whose roll and pitch angles are already calculated
+ * @param terms The numerators and denominators of the roll and pitch equations of the estimation
+ */
+void AttitudeEstimator::calculateRepresentations(const AttitudeEstimation& estimation, AttitudeTerms terms)
 {
-    return std::atan(-reading.accel_x_axis/std::sqrt(reading.accel_y_axis*reading.accel_y_axis + reading.accel_z_axis*reading.accel_z_axis));
+    const AttitudeOutputFormat& outputFormat = representations.format;
+    if (outputFormat.degrees) {
+        representations.degrees.push_back({estimation.roll*180.0/M_PI, estimation.pitch*180.0/M_PI});
+    }
+
+    if (!outputFormat.quaternion && !outputFormat.rotation_matrix) {
+        return;
+    }
+
+    // Sine and cosine of the roll angle from the atan2 arguments used by calculateRoll. As std::atan2(0, 0)
+    // is zero, a zero norm gives the sine and cosine of a zero roll angle
+    double rollNorm = std::sqrt(terms.rollNumerator*terms.rollNumerator + terms.rollDenominator*terms.rollDenominator);
+    double sinRoll = (rollNorm > 0) ? terms.rollNumerator/rollNorm : 0.0;
+    double cosRoll = (rollNorm > 0) ? terms.rollDenominator/rollNorm : 1.0;
+
+    // Sine and cosine of the pitch angle from the atan argument used by calculatePitch, whose norm is the
+    // accelerometer magnitude. As the pitch angle of an all-zero reading is NaN, a zero magnitude is left
+    // to give NaN here too
+    double sinPitch = terms.pitchNumerator/terms.accelMagnitude;
+    double cosPitch = terms.pitchDenominator/terms.accelMagnitude;
+
+    if (outputFormat.quaternion) {
+        // Half angle identities, keeping the sign of the sine of each half angle equal to the sign of the angle.
+        // std::max(value, 0.0) only clamps rounding errors below zero: with NaN as its first argument it returns NaN
+        double cosHalfRoll = std::sqrt(std::max((1.0 + cosRoll)/2.0, 0.0));
+        double sinHalfRoll = sign(sinRoll)*std::sqrt(std::max((1.0 - cosRoll)/2.0, 0.0));
+        double cosHalfPitch = std::sqrt(std::max((1.0 + cosPitch)/2.0, 0.0));
+        double sinHalfPitch = sign(sinPitch)*std::sqrt(std::max((1.0 - cosPitch)/2.0, 0.0));
+
+        representations.quaternion.push_back({
+            cosHalfRoll*cosHalfPitch,
+            sinHalfRoll*cosHalfPitch,
+            cosHalfRoll*sinHalfPitch,
+            -sinHalfRoll*sinHalfPitch
+        });
+    }
+
+    if (outputFormat.rotation_matrix) {
+        representations.rotation_matrix.push_back({
+            cosPitch, sinRoll*sinPitch, cosRoll*sinPitch,
+            0.0, cosRoll, -sinRoll,
+            -sinPitch, sinRoll*cosPitch, cosRoll*cosPitch
+        });
+    }
 }
 
 /**
@@ -0,0 +1,236 @@
+/**
+ * @file window-statistics.cpp
+ * @author agent (agent@local)
+ * @brief Online sliding window statistics of the accelerometer magnitude and attitude
+ * @date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#include "window-statistics.h"
+
+/**
+ * @brief Add a sample to the accumulator
+ * 
+ * @param value The sample to be added
+ */
+void WelfordAccumulator::add(double value)
+{
+    count++;
+    double delta = value - mean;
+    mean += delta/count;
+    m2 += delta*(value - mean);
+}
+
+/**
+ * @brief Remove a sample previously added to the accumulator by reversing the Welford update
+ * 
+ * @param value The sample to be removed
+ */
+void WelfordAccumulator::remove(double value)
+{
+    if (count <= 1) {
+        count = 0;
+        mean = 0.0;
+        m2 = 0.0;
+        return;
+    }
+
+    count--;
+    double delta = value - mean;
+    mean -= delta/count;
+    m2 -= delta*(value - mean);
+
+    // Prevent rounding errors from producing a negative variance
+    if (m2 < 0) {
+        m2 = 0.0;
+    }
+}
+
+/**
+ * @brief Get the population variance of the accumulated samples
+ * 
+ * @return double The variance, or zero if there are no samples
+ */
+double WelfordAccumulator::variance() const
+{
+    if (count == 0) {
+        return 0.0;
+    }
+    return m2/count;
+}
+
+/**
+ * @brief Construct a new WindowStatistics::WindowStatistics object
+ * 
+ * @param windowLengthMs_ The length of the sliding window in [ms]. Zero disables the statistics
+ * @param vibrationThreshold_ The accelerometer magnitude standard deviation threshold in [mg]. Zero disables it
+ * @param attitudeThreshold_ The roll and pitch standard deviation threshold in [rad]. Zero disables it
+ */
+WindowStatistics::WindowStatistics(int windowLengthMs_, double vibrationThreshold_, double attitudeThreshold_)
+{
+    windowLengthMs = windowLengthMs_;
+    vibrationThreshold = vibrationThreshold_;
+    attitudeThreshold = attitudeThreshold_;
+}
+
+/**
+ * @brief Check if the statistics are enabled
+ * 
+ * @return true
+ * @return false
+ */
+bool WindowStatistics::isEnabled() const
+{
+    return windowLengthMs > 0;
+}
+
+/**
+ * @brief Add a sample to the sliding window, dropping the samples that fall out of it. The roll
+ * angle is unwrapped with respect to the previous sample, so that readings alternating around
+ * +pi rad and -pi rad do not show up as a large variance. Samples with a non-finite accelerometer
+ * magnitude, roll or pitch angle, such as the NaN pitch of an all-zero reading, are skipped, since
+ * they could never be removed from the running statistics again.
+ * 
+ * @param estimation The attitude estimation of the sample
+ * @param accelMagnitudeValue The accelerometer magnitude of the sample in [mg], as already calculated by the estimator
+ */
+void WindowStatistics::addSample(const AttitudeEstimation& estimation, double accelMagnitudeValue)
+{
+    if (!std::isfinite(accelMagnitudeValue) || !std::isfinite(estimation.roll) || !std::isfinite(estimation.pitch)) {
+        return;
+    }
+
+    // Unwrap the roll angle with respect to the previous sample
+    double unwrappedRoll = estimation.roll;
+    if (samples.empty()) {
+        firstTimeStampMs = estimation.time_stamp_ms;
+        lastSummaryTimeStampMs = estimation.time_stamp_ms;
+    }
+    else {
+        unwrappedRoll = previousUnwrappedRoll + std::remainder(estimation.roll - previousRoll, 2*M_PI);
+    }
+    previousRoll = estimation.roll;
+    previousUnwrappedRoll = unwrappedRoll;
+
+    // Add the new sample to the window
+    WindowSample sample;
+    sample.time_stamp_ms = estimation.time_stamp_ms;
+    sample.accel_magnitude = accelMagnitudeValue;
+    sample.roll = unwrappedRoll;
+    sample.pitch = estimation.pitch;
+    samples.push_back(sample);
+    accelMagnitude.add(sample.accel_magnitude);
+    roll.add(sample.roll);
+    pitch.add(sample.pitch);
+
+    // Drop the samples that are no longer within the window
+    while (estimation.time_stamp_ms - samples.front().time_stamp_ms >= windowLengthMs) {
+        accelMagnitude.remove(samples.front().accel_magnitude);
+        roll.remove(samples.front().roll);
+        pitch.remove(samples.front().pitch);
+        samples.pop_front();
+    }
+
+    // Thresholds are only checked once a full window of samples is available
+    if (estimation.time_stamp_ms - firstTimeStampMs < windowLengthMs) {
+        return;
+    }
+
+    WindowSummary summary = summarize(estimation.time_stamp_ms);
+    summary.vibration_alert_started = summary.vibration_alert && !vibrationAlertActive;
+    summary.attitude_alert_started = summary.attitude_alert && !attitudeAlertActive;
+    if (summary.vibration_alert_started || summary.attitude_alert_started) {
+        alerts.push_back(summary);
+    }
+    vibrationAlertActive = summary.vibration_alert;
+    attitudeAlertActive = summary.attitude_alert;
+
+    if (estimation.time_stamp_ms - lastSummaryTimeStampMs >= windowLengthMs) {
+        summaries.push_back(summary);
+        lastSummaryTimeStampMs = estimation.time_stamp_ms;
+    }
+}
+
+/**
+ * @brief Get the summaries recorded at the end of each window
+ * 
+ * @return const std::vector<WindowSummary>& A vector containing the window summaries
+ */
+const std::vector<WindowSummary>& WindowStatistics::getWindowSummaries() const
+{
+    return summaries;
+}
+
+/**
+ * @brief Get the summaries recorded whenever a threshold started being exceeded. The
+ * vibration_alert_started and attitude_alert_started flags tell which thresholds did.
+ * 
+ * @return const std::vector<WindowSummary>& A vector containing the alert summaries
+ */
+const std::vector<WindowSummary>& WindowStatistics::getAlerts() const
+{
+    return alerts;
+}
+
+/**
+ * @brief Summarize the samples currently in the window
+ * 
+ * @param time_stamp_ms The timestamp of the last sample in the window in [ms]
+ * @return WindowSummary The summary of the window
+ */
+WindowSummary WindowStatistics::summarize(int time_stamp_ms)
+{
+    WindowSummary summary;
+    summary.time_stamp_ms = time_stamp_ms;
+    summary.sample_count = samples.size();
+    summary.accel_magnitude_mean = accelMagnitude.mean;
+    summary.accel_magnitude_variance = accelMagnitude.variance();
+    summary.roll_mean = std::remainder(roll.mean, 2*M_PI);
+    summary.roll_variance = roll.variance();
+    summary.pitch_mean = pitch.mean;
+    summary.pitch_variance = pitch.variance();
+
+    // Compare the variances with the squared thresholds to avoid computing square roots
+    summary.vibration_alert = (vibrationThreshold > 0) && (summary.accel_magnitude_variance > vibrationThreshold*vibrationThreshold);
+    summary.attitude_alert = (attitudeThreshold > 0) && ((summary.roll_variance > attitudeThreshold*attitudeThreshold) || (summary.pitch_variance > attitudeThreshold*attitudeThreshold));
+
+    return summary;
+}
+
+/**
+ * @brief Function that writes a file containing window statistics summaries
+ * 
+ * @param windowSummaries A vector containing the window summaries
+ * @param windowSummaryFilePath The path to the window statistics file to be created
+ */
+void writeWindowSummaryFile(const std::vector<WindowSummary>& windowSummaries, std::string windowSummaryFilePath)
+{
+    // Check if the window summary vector contains data
+    if (windowSummaries.size() == 0) {
+        std::cout << "Could not generate a window statistics file because the window summary vector is empty\n";
+        return;
+    }
+
+    // Create window statistics file
+    std::ofstream windowSummaryFile;
+    windowSummaryFile.open(windowSummaryFilePath);
+
+    // Write the window summaries to the file
+    if(windowSummaryFile.is_open())
+    {
+        for(int i=0; i<windowSummaries.size(); i++){
+            windowSummaryFile << windowSummaries[i].time_stamp_ms << "; " << windowSummaries[i].sample_count << "; "
+                << windowSummaries[i].accel_magnitude_mean << "; " << windowSummaries[i].accel_magnitude_variance << "; "
+                << windowSummaries[i].roll_mean << "; " << windowSummaries[i].roll_variance << "; "
+                << windowSummaries[i].pitch_mean << "; " << windowSummaries[i].pitch_variance << "; "
+                << windowSummaries[i].vibration_alert << "; " << windowSummaries[i].attitude_alert << '\n';
+        }
+        windowSummaryFile.close();
+        std::cout << "Window statistics successfully written to " << windowSummaryFilePath << '\n';
+    }
+    else {
+        throw std::runtime_error("Error: could not write window statistics to " + windowSummaryFilePath);
+    }
+}
\ No newline at end of file
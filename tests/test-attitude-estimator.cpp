@@ -42,5 +42,65 @@ int main(int argc, char *argv[]) {
         }
     }
 
+    // Create another object of the AttitudeEstimator class with all the additional attitude representations enabled
+    AttitudeOutputFormat format;
+    format.degrees = true;
+    format.quaternion = true;
+    format.rotation_matrix = true;
+    AttitudeEstimator representationsTester = AttitudeEstimator(accelerometerData, format);
+    AttitudeRepresentations actualRepresentations = representationsTester.getAttitudeRepresentations();
+
+    // Check if only the selected representations were stored, with one element per estimation
+    if (actualRepresentations.degrees.size() != expectedEstimation.size() || actualRepresentations.quaternion.size() != expectedEstimation.size() || actualRepresentations.rotation_matrix.size() != expectedEstimation.size()) {
+        failed = true;
+        std::cout << "Expected " << expectedEstimation.size() << " elements in each selected attitude representation\n";
+    }
+    if (!attitudeEstimatorTester.getAttitudeRepresentations().degrees.empty() || attitudeEstimatorTester.getOutputFormat().any()) {
+        failed = true;
+        std::cout << "Expected no attitude representation to be stored when none is selected\n";
+    }
+
+    // Check if the additional representations match the ones calculated from the expected roll and pitch angles
+    for (int i = 0; i < expectedEstimation.size() && !failed; i++) {
+        double roll = expectedEstimation[i].roll, pitch = expectedEstimation[i].pitch;
+        std::vector<double> expectedValues = {
+            roll*180.0/M_PI, pitch*180.0/M_PI,
+            std::cos(roll/2)*std::cos(pitch/2), std::sin(roll/2)*std::cos(pitch/2), std::cos(roll/2)*std::sin(pitch/2), -std::sin(roll/2)*std::sin(pitch/2),
+            std::cos(pitch), std::sin(roll)*std::sin(pitch), std::cos(roll)*std::sin(pitch),
+            0.0, std::cos(roll), -std::sin(roll),
+            -std::sin(pitch), std::sin(roll)*std::cos(pitch), std::cos(roll)*std::cos(pitch)
+        };
+        std::vector<double> actualValues(actualRepresentations.degrees[i].begin(), actualRepresentations.degrees[i].end());
+        actualValues.insert(actualValues.end(), actualRepresentations.quaternion[i].begin(), actualRepresentations.quaternion[i].end());
+        actualValues.insert(actualValues.end(), actualRepresentations.rotation_matrix[i].begin(), actualRepresentations.rotation_matrix[i].end());
+
+        for (int j = 0; j < expectedValues.size(); j++) {
+            // Angles in degrees are compared with a tolerance scaled accordingly
+            double scaledTolerance = (j < 2) ? tolerance*180.0/M_PI : tolerance;
+            if (std::abs(expectedValues[j] - actualValues[j]) > scaledTolerance) {
+                failed = true;
+                std::cout << "In estimation " << i << " expected representation value " << j << " to be " << expectedValues[j] << " but actual value is " << actualValues[j] << " for a tolerance of " << scaledTolerance << '\n';
+            }
+        }
+    }
+
+    // Check that an all-zero reading, whose pitch angle is undefined, gives NaN in every quaternion element and in every
+    // rotation matrix element that depends on the pitch angle, that is, all but the middle row
+    std::vector<AccelerometerReading> zeroReading;
+    zeroReading.push_back(AccelerometerReading(54771, 0, 0, 0));
+    AttitudeRepresentations zeroRepresentations = AttitudeEstimator(zeroReading, format).getAttitudeRepresentations();
+    for (double value : zeroRepresentations.quaternion[0]) {
+        if (!std::isnan(value)) {
+            failed = true;
+            std::cout << "Expected a NaN quaternion for an all-zero reading but got element " << value << '\n';
+        }
+    }
+    for (int j : {0, 1, 2, 6, 7, 8}) {
+        if (!std::isnan(zeroRepresentations.rotation_matrix[0][j])) {
+            failed = true;
+            std::cout << "Expected a NaN rotation matrix element " << j << " for an all-zero reading but got " << zeroRepresentations.rotation_matrix[0][j] << '\n';
+        }
+    }
+
     std::cout << "Class AttitudeEstimator " << ((failed==false)?"PASSED":"FAILED") << " its test\n";
 }
@@ -0,0 +1,135 @@
+/**
+ * @file test-window-statistics.cpp
+ * @author agent (agent@local)
+ * @brief Program to test the WindowStatistics class
+ * @date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#include <iostream>
+#include "window-statistics.h"
+
+/**
+ * @brief Calculate the accelerometer magnitude of a reading, as done by the attitude estimator
+ * 
+ * @param reading A single accelerometer reading
+ * @return double The accelerometer magnitude in [mg]
+ */
+double accelMagnitude(AccelerometerReading reading)
+{
+    return std::sqrt(reading.accel_x_axis*reading.accel_x_axis + reading.accel_y_axis*reading.accel_y_axis + reading.accel_z_axis*reading.accel_z_axis);
+}
+
+int main(int argc, char *argv[]) {
+    // Create dummy accelerometer data readings every 10 ms, upside down so that the roll angle alternates
+    // around +pi rad and -pi rad, and with a vibration on the z axis starting at 100 ms
+    std::vector<AccelerometerReading> accelerometerData;
+    std::vector<AttitudeEstimation> estimation;
+    for (int i = 0; i < 20; i++) {
+        int accel_y_axis = (i%2 == 0) ? 5 : -5;
+        int accel_z_axis = (i < 10) ? -1000 : ((i%2 == 0) ? -900 : -1100);
+        accelerometerData.push_back(AccelerometerReading(10*i, 20, accel_y_axis, accel_z_axis));
+        estimation.push_back(AttitudeEstimation(10*i, std::atan2(accel_y_axis, accel_z_axis), std::atan(-20/std::sqrt(accel_y_axis*accel_y_axis + accel_z_axis*accel_z_axis))));
+    }
+
+    // Create an object of the WindowStatistics class with a 50 ms window and feed it with the dummy data
+    int windowLengthMs = 50;
+    WindowStatistics windowStatisticsTester = WindowStatistics(windowLengthMs, 50.0, 0.05);
+    for (int i = 0; i < accelerometerData.size(); i++) {
+        windowStatisticsTester.addSample(estimation[i], accelMagnitude(accelerometerData[i]));
+    }
+    std::vector<WindowSummary> actualSummaries = windowStatisticsTester.getWindowSummaries();
+    std::vector<WindowSummary> actualAlerts = windowStatisticsTester.getAlerts();
+
+    // Check each summary against the mean and variance calculated directly over the samples in its window
+    bool failed = false;
+    float tolerance = 0.0001;
+    if (actualSummaries.size() != 3) {
+        failed = true;
+        std::cout << "Expected 3 window summaries but got " << actualSummaries.size() << '\n';
+    }
+    for (int i = 0; i < actualSummaries.size(); i++) {
+        std::vector<double> magnitude, roll, pitch;
+        for (int j = 0; j < accelerometerData.size(); j++) {
+            int age = actualSummaries[i].time_stamp_ms - accelerometerData[j].time_stamp_ms;
+            if (age >= 0 && age < windowLengthMs) {
+                magnitude.push_back(accelMagnitude(accelerometerData[j]));
+                roll.push_back((estimation[j].roll < 0) ? estimation[j].roll + 2*M_PI : estimation[j].roll);
+                pitch.push_back(estimation[j].pitch);
+            }
+        }
+
+        std::vector<double> expectedValues, actualValues = {
+            actualSummaries[i].accel_magnitude_mean, actualSummaries[i].accel_magnitude_variance,
+            std::abs(actualSummaries[i].roll_mean), actualSummaries[i].roll_variance,
+            actualSummaries[i].pitch_mean, actualSummaries[i].pitch_variance
+        };
+        for (std::vector<double> values : {magnitude, roll, pitch}) {
+            double mean = 0.0, variance = 0.0;
+            for (int j = 0; j < values.size(); j++) {
+                mean += values[j]/values.size();
+            }
+            for (int j = 0; j < values.size(); j++) {
+                variance += (values[j] - mean)*(values[j] - mean)/values.size();
+            }
+            expectedValues.push_back(mean);
+            expectedValues.push_back(variance);
+        }
+        expectedValues[2] = std::abs(std::remainder(expectedValues[2], 2*M_PI));
+
+        for (int j = 0; j < expectedValues.size(); j++) {
+            if (std::abs(expectedValues[j] - actualValues[j]) > tolerance*std::max(1.0, std::abs(expectedValues[j]))) {
+                failed = true;
+                std::cout << "In window summary " << i << " expected statistic " << j << " to be " << expectedValues[j] << " but actual is " << actualValues[j] << '\n';
+            }
+        }
+    }
+
+    // Check that a single vibration alert was raised once the vibration dominated the window, and no attitude alert
+    if (actualAlerts.size() != 1 || !actualAlerts[0].vibration_alert_started || actualAlerts[0].attitude_alert || actualAlerts[0].time_stamp_ms != 110) {
+        failed = true;
+        std::cout << "Expected a single vibration alert at 110 ms but got " << actualAlerts.size() << " alerts\n";
+    }
+
+    // Keep the vibration and add a pitch oscillation starting at 200 ms, so that the attitude threshold
+    // is crossed while the vibration threshold is still being exceeded
+    for (int i = 20; i < 30; i++) {
+        int accel_x_axis = (i%2 == 0) ? 200 : -200;
+        int accel_y_axis = (i%2 == 0) ? 5 : -5;
+        int accel_z_axis = (i%2 == 0) ? -900 : -1100;
+        AccelerometerReading reading = AccelerometerReading(10*i, accel_x_axis, accel_y_axis, accel_z_axis);
+        windowStatisticsTester.addSample(AttitudeEstimation(10*i, std::atan2(accel_y_axis, accel_z_axis), std::atan(-accel_x_axis/std::sqrt(accel_y_axis*accel_y_axis + accel_z_axis*accel_z_axis))), accelMagnitude(reading));
+    }
+    actualAlerts = windowStatisticsTester.getAlerts();
+
+    // Check that the second alert only reports the attitude threshold as started, even though the vibration is still active
+    if (actualAlerts.size() != 2 || actualAlerts[1].time_stamp_ms < 200 || !actualAlerts[1].attitude_alert_started || actualAlerts[1].vibration_alert_started || !actualAlerts[1].vibration_alert) {
+        failed = true;
+        std::cout << "Expected a second alert reporting only the attitude threshold as started but got " << actualAlerts.size() << " alerts\n";
+    }
+
+    // Feed a new object with an all-zero reading, whose pitch angle is NaN, between steady upside down readings
+    WindowStatistics dropoutTester = WindowStatistics(windowLengthMs, 50.0, 0.05);
+    for (int i = 0; i < 40; i++) {
+        int accel_y_axis = (i%2 == 0) ? 5 : -5;
+        AccelerometerReading reading = (i == 5) ? AccelerometerReading(10*i, 0, 0, 0) : AccelerometerReading(10*i, 20, accel_y_axis, -1000);
+        double rollEstimate = std::atan2(reading.accel_y_axis, reading.accel_z_axis);
+        double pitchEstimate = std::atan(-reading.accel_x_axis/std::sqrt(reading.accel_y_axis*reading.accel_y_axis + reading.accel_z_axis*reading.accel_z_axis));
+        dropoutTester.addSample(AttitudeEstimation(10*i, rollEstimate, pitchEstimate), accelMagnitude(reading));
+    }
+
+    // Check that the statistics are finite once the reading has left the window, and that it did not disturb the roll unwrapping
+    std::vector<WindowSummary> dropoutSummaries = dropoutTester.getWindowSummaries();
+    if (dropoutSummaries.empty() || !std::isfinite(dropoutSummaries.back().pitch_mean) || !std::isfinite(dropoutSummaries.back().pitch_variance) || dropoutSummaries.back().roll_variance > 0.001) {
+        failed = true;
+        std::cout << "Expected finite pitch statistics and a small roll variance after an all-zero reading left the window\n";
+    }
+    if (!dropoutTester.getAlerts().empty()) {
+        failed = true;
+        std::cout << "Expected no alert for steady readings with an all-zero reading in between but got " << dropoutTester.getAlerts().size() << '\n';
+    }
+
+    std::cout << "Class WindowStatistics " << ((failed==false)?"PASSED":"FAILED") << " its test\n";
+}
\ No newline at end of file
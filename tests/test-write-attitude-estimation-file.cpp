@@ -50,5 +50,68 @@ int main(int argc, char *argv[]) {
         failed = true;
     }
 
+    // Create dummy additional attitude representations with all of them selected, each element holding a distinct value
+    AttitudeRepresentations representations;
+    representations.format.degrees = true;
+    representations.format.quaternion = true;
+    representations.format.rotation_matrix = true;
+    for (int i = 0; i < expectedEstimationData.size(); i++) {
+        representations.degrees.push_back({i + 0.1, i + 0.2});
+        representations.quaternion.push_back({i + 0.3, i + 0.4, i + 0.5, i + 0.6});
+        representations.rotation_matrix.push_back({i + 0.7, i + 0.8, i + 0.9, i + 1.0, i + 1.1, i + 1.2, i + 1.3, i + 1.4, i + 1.5});
+    }
+
+    // Write output file with the additional representations
+    std::string representationsFilePath = "dummy_attitude_representations_data.log";
+    writeAttitudeEstimationFile(expectedEstimationData, representationsFilePath, representations);
+
+    // Check if each line contains the timestamp, roll, pitch, degrees, quaternion and rotation matrix columns in this order
+    std::ifstream representationsDataFile(representationsFilePath);
+    int lineIndex = 0;
+    while(std::getline(representationsDataFile,line)){
+        std::istringstream representationsDataStream(line);
+        std::string column;
+        std::vector<double> actualColumns;
+        while(std::getline(representationsDataStream,column,';')){
+            actualColumns.push_back(stod(column));
+        }
+
+        std::vector<double> expectedColumns = {(double)expectedEstimationData[lineIndex].time_stamp_ms, expectedEstimationData[lineIndex].roll, expectedEstimationData[lineIndex].pitch};
+        expectedColumns.insert(expectedColumns.end(), representations.degrees[lineIndex].begin(), representations.degrees[lineIndex].end());
+        expectedColumns.insert(expectedColumns.end(), representations.quaternion[lineIndex].begin(), representations.quaternion[lineIndex].end());
+        expectedColumns.insert(expectedColumns.end(), representations.rotation_matrix[lineIndex].begin(), representations.rotation_matrix[lineIndex].end());
+
+        if (actualColumns.size() != 18 || actualColumns.size() != expectedColumns.size()) {
+            failed = true;
+            std::cout << "In line " << lineIndex << " expected 18 columns but got " << actualColumns.size() << '\n';
+            break;
+        }
+        for (int j = 0; j < expectedColumns.size(); j++) {
+            if (std::abs(expectedColumns[j] - actualColumns[j]) > 0.0001) {
+                failed = true;
+                std::cout << "In line " << lineIndex << " expected column " << j << " to be " << expectedColumns[j] << " but actual is " << actualColumns[j] << '\n';
+            }
+        }
+        lineIndex++;
+    }
+    if (lineIndex != expectedEstimationData.size()) {
+        failed = true;
+        std::cout << "Expected " << expectedEstimationData.size() << " lines with attitude representations but got " << lineIndex << '\n';
+    }
+
+    // Check if a selected representation with a different number of elements than the estimations is rejected
+    representations.quaternion.pop_back();
+    bool thrown = false;
+    try {
+        writeAttitudeEstimationFile(expectedEstimationData, representationsFilePath, representations);
+    }
+    catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    if (!thrown) {
+        failed = true;
+        std::cout << "Expected mismatched attitude representations to throw a runtime_error\n";
+    }
+
     std::cout << "Function writeAttitudeEstimationFile " << ((failed==false)?"PASSED":"FAILED") << " its test\n";
 }
\ No newline at end of file